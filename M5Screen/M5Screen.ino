@@ -26,6 +26,15 @@ int chunksReceived = 0;
 unsigned long lastChunkTime = 0;
 const int CHUNK_TIMEOUT = 1000; // 1 second timeout
 
+// Frame packet: [0xAA 0x55] [chunk_index] [frame_id u16] [capture_us u32] [chunk_data]
+const int HEADER_SIZE = 9;
+
+// Latency report sent back after each displayed frame, describing the chunk that completed it:
+// [0xAA 0x56] [frame_id u16] [capture_us u32] [chunk_index]
+// [chunk_rx_us u32] [complete_us u32] [displayed_us u32] [mixed]
+const int REPORT_SIZE = 22;
+uint16_t chunkFrameIds[TOTAL_CHUNKS]; // frame id each buffered chunk came from
+
 void connectWiFi() {
   WiFi.mode(WIFI_STA);
   WiFi.begin(WIFI_SSID, WIFI_PASS);
@@ -47,6 +56,34 @@ void renderFramebufferToTFT() {
   StickCP2.Display.pushImage(0, 0, FB_WIDTH, FB_HEIGHT, tftBuffer);
 }
 
+// Echo frame timing back to the sender so it can measure glass-to-glass latency.
+// Lost chunks are still filled from neighbouring frames; such frames are flagged as mixed.
+void sendLatencyReport(uint16_t frameId, uint32_t captureUs, uint8_t chunkIndex,
+                       uint32_t chunkRxUs, uint32_t completeUs, uint32_t displayedUs) {
+  uint8_t mixed = 0;
+  for (int i = 0; i < TOTAL_CHUNKS; i++) {
+    if (chunkFrameIds[i] != frameId) {
+      mixed = 1;
+      break;
+    }
+  }
+
+  uint8_t report[REPORT_SIZE];
+  report[0] = 0xAA;
+  report[1] = 0x56;
+  memcpy(report + 2, &frameId, 2);
+  memcpy(report + 4, &captureUs, 4);
+  report[8] = chunkIndex;
+  memcpy(report + 9, &chunkRxUs, 4);
+  memcpy(report + 13, &completeUs, 4);
+  memcpy(report + 17, &displayedUs, 4);
+  report[21] = mixed;
+
+  Udp.beginPacket(Udp.remoteIP(), Udp.remotePort());
+  Udp.write(report, REPORT_SIZE);
+  Udp.endPacket();
+}
+
 void setup() {
   Serial.begin(115200);
   delay(1000);
@@ -135,9 +172,10 @@ void loop() {
     }
   }
 
-  // Packet format: [0xAA 0x55] [chunk_index 1 byte] [chunk_data]
-  // Frame packets are at least 3 bytes (header + index + data)
-  if (packetSize < 3) {
+  uint32_t rxUs = micros();
+
+  // Frame packets are at least HEADER_SIZE bytes
+  if (packetSize < HEADER_SIZE) {
     Serial.print("Packet too small: ");
     Serial.println(packetSize);
     while (Udp.available()) Udp.read();
@@ -145,9 +183,9 @@ void loop() {
   }
 
   // Read header
-  uint8_t header[3];
-  int readHeader = Udp.read(header, 3);
-  if (readHeader != 3) {
+  uint8_t header[HEADER_SIZE];
+  int readHeader = Udp.read(header, HEADER_SIZE);
+  if (readHeader != HEADER_SIZE) {
     Serial.println("Failed to read header");
     while (Udp.available()) Udp.read();
     return;
@@ -170,6 +208,11 @@ void loop() {
     return;
   }
 
+  uint16_t frameId;
+  uint32_t captureUs;
+  memcpy(&frameId, header + 3, 2);
+  memcpy(&captureUs, header + 5, 4);
+
   // Calculate chunk offset and size
   int offset = chunkIndex * CHUNK_SIZE;
   int chunkDataSize = min(CHUNK_SIZE, FB_SIZE - offset);
@@ -188,12 +231,15 @@ void loop() {
       receivedChunks[chunkIndex] = 1;
       chunksReceived++;
     }
+    chunkFrameIds[chunkIndex] = frameId;
     lastChunkTime = millis();
 
     // Check if all chunks received
     if (chunksReceived == TOTAL_CHUNKS) {
       // All chunks received, render immediately
+      uint32_t completeUs = micros();
       renderFramebufferToTFT();
+      sendLatencyReport(frameId, captureUs, chunkIndex, rxUs, completeUs, micros());
       
       // Reset for next frame
       memset(receivedChunks, 0, sizeof(receivedChunks));
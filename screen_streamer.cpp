@@ -9,6 +9,8 @@
 #include <chrono>
 #include <atomic>
 #include <cmath>
+#include <algorithm>
+#include <mutex>
 
 #pragma comment(lib, "ws2_32.lib")
 #pragma comment(lib, "gdi32.lib")
@@ -20,6 +22,22 @@ const int DISPLAY_HEIGHT = 135;
 const int CHUNK_SIZE = 1400;
 const int FRAME_SIZE = DISPLAY_WIDTH * DISPLAY_HEIGHT * 2;
 const int UDP_PORT = 3333;
+const int NUM_CHUNKS = (FRAME_SIZE + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+// Frame packet: [0xAA 0x55] [chunk_index] [frame_id u16] [capture_us u32] [chunk_data]
+const int HEADER_SIZE = 9;
+// Device report: [0xAA 0x56] [frame_id u16] [capture_us u32] [chunk_index]
+//                [chunk_rx_us u32] [complete_us u32] [displayed_us u32] [mixed]
+const int REPORT_SIZE = 22;
+
+// Packet pacing - spread a frame's chunks over the frame interval instead of one burst
+const int PACER_BURST_PACKETS = 4;      // bucket depth, in full-size packets (absorbs timer overshoot)
+const float PACER_AUTO_SPREAD = 0.6f;   // auto mode: fraction of the frame interval to send over
+const double PACER_SPIN_TAIL = 0.0001;  // seconds spun after a high-resolution timer wakeup
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 #define COLOR_BG RGB(15, 15, 15)
 #define COLOR_TEXT RGB(180, 180, 180)
@@ -34,6 +52,7 @@ const int UDP_PORT = 3333;
 #define ID_CURSOR_CHECK 1002
 #define ID_FPS_COMBO 1003
 #define ID_SCREEN_COMBO 1005
+#define ID_PACING_COMBO 1006
 
 struct MonitorInfo {
     HMONITOR hMonitor;
@@ -44,8 +63,8 @@ struct MonitorInfo {
 
 std::vector<MonitorInfo> g_monitors;
 
-HWND g_hwndMain, g_hwndStatus, g_hwndFPS, g_hwndIP, g_hwndStartStop;
-HWND g_hwndCursorCheck, g_hwndFPSCombo, g_hwndPreview, g_hwndScreenCombo;
+HWND g_hwndMain, g_hwndStatus, g_hwndFPS, g_hwndIP, g_hwndStartStop, g_hwndLatency;
+HWND g_hwndCursorCheck, g_hwndFPSCombo, g_hwndPreview, g_hwndScreenCombo, g_hwndPacingCombo;
 HBRUSH g_hBrushBg;
 HFONT g_hFontLarge, g_hFontNormal, g_hFontSmall;
 std::thread* g_streamThread = nullptr;
@@ -56,6 +75,7 @@ std::atomic<bool> g_showCursor(true);
 std::atomic<int> g_targetFPS(30);
 std::atomic<int> g_selectedScreen(0);
 std::atomic<int> g_lastSelectedScreen(0);
+std::atomic<int> g_pacingMbps(0);  // 0 = auto, -1 = off
 
 inline uint8_t clamp(int val) {
     return (val < 0) ? 0 : (val > 255) ? 255 : val;
@@ -67,6 +87,17 @@ inline uint16_t rgb888_to_rgb565(uint8_t r, uint8_t g, uint8_t b) {
     return (rgb >> 8) | (rgb << 8);
 }
 
+// Reverse of rgb888_to_rgb565 (byte-swapped RGB565 back to RGB888)
+inline void rgb565_to_rgb888(uint16_t rgb565, uint8_t& r, uint8_t& g, uint8_t& b) {
+    rgb565 = (rgb565 >> 8) | (rgb565 << 8);
+    r = (rgb565 >> 8) & 0xF8;
+    g = (rgb565 >> 3) & 0xFC;
+    b = (rgb565 << 3) & 0xF8;
+    r |= (r >> 5);
+    g |= (g >> 6);
+    b |= (b >> 5);
+}
+
 void UpdateStatus(const char* text) {
     SetWindowTextA(g_hwndStatus, text);
 }
@@ -77,6 +108,236 @@ void UpdateFPS(float fps) {
     SetWindowTextA(g_hwndFPS, buf);
 }
 
+void UpdateLatency(const char* text) {
+    SetWindowTextA(g_hwndLatency, text);
+}
+
+// Host clock in microseconds (wraps every ~71 min, like micros() on the ESP32)
+inline uint32_t hostMicros() {
+    // Called from the stream and report threads - static init is thread-safe
+    static const LONGLONG freq = [] { LARGE_INTEGER f; QueryPerformanceFrequency(&f); return f.QuadPart; }();
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (uint32_t)((t.QuadPart / freq) * 1000000 + (t.QuadPart % freq) * 1000000 / freq);
+}
+
+// Glass-to-glass latency: matches device reports to host send times and
+// estimates the device clock offset NTP-style (min-RTT sample in a window)
+class LatencyTracker {
+private:
+    struct FrameTiming {
+        bool valid;
+        uint16_t frameId;
+        uint32_t captureUs;
+        uint32_t sentUs;
+        uint32_t chunkSendUs[NUM_CHUNKS];
+    };
+    struct OffsetSample {
+        uint32_t offset;  // device clock - host clock
+        int32_t rtt;
+    };
+
+    static const int HISTORY = 64;
+    static const int OFFSET_WINDOW = 32;
+
+    FrameTiming frames[HISTORY];
+    OffsetSample offsetSamples[OFFSET_WINDOW];
+    int offsetCount, offsetNext;
+    uint32_t offsetUs;
+    int framesSent;
+    int framesMixed;
+    std::vector<int> capToTx, txToRx, rxToDisp, total;
+    std::mutex lock;  // reports arrive on the receive thread
+
+    static void appendStage(char* buf, size_t len, const char* name, std::vector<int>& v) {
+        std::sort(v.begin(), v.end());
+        int p50 = v[v.size() / 2];
+        int p95 = v[std::min(v.size() - 1, v.size() * 95 / 100)];
+        size_t used = strlen(buf);
+        snprintf(buf + used, len - used, "  %s %.1f/%.1f", name, p50 / 1000.0f, p95 / 1000.0f);
+    }
+
+public:
+    LatencyTracker() : offsetCount(0), offsetNext(0), offsetUs(0), framesSent(0), framesMixed(0) {
+        for (int i = 0; i < HISTORY; i++) frames[i].valid = false;
+    }
+
+    void onCapture(uint16_t frameId, uint32_t captureUs) {
+        std::lock_guard<std::mutex> guard(lock);
+        FrameTiming& f = frames[frameId % HISTORY];
+        f.valid = false;
+        f.frameId = frameId;
+        f.captureUs = captureUs;
+    }
+
+    void onChunkSent(uint16_t frameId, int chunkIdx, uint32_t us) {
+        std::lock_guard<std::mutex> guard(lock);
+        frames[frameId % HISTORY].chunkSendUs[chunkIdx] = us;
+    }
+
+    void onFrameSent(uint16_t frameId, uint32_t us) {
+        std::lock_guard<std::mutex> guard(lock);
+        FrameTiming& f = frames[frameId % HISTORY];
+        f.sentUs = us;
+        f.valid = true;
+        framesSent++;
+    }
+
+    // Reports describe the chunk that completed a frame on the device
+    void onReport(const uint8_t* data, uint32_t recvUs) {
+        std::lock_guard<std::mutex> guard(lock);
+        uint16_t frameId;
+        uint32_t captureUs, chunkRxUs, completeUs, displayedUs;
+        memcpy(&frameId, data + 2, 2);
+        memcpy(&captureUs, data + 4, 4);
+        uint8_t chunkIdx = data[8];
+        memcpy(&chunkRxUs, data + 9, 4);
+        memcpy(&completeUs, data + 13, 4);
+        memcpy(&displayedUs, data + 17, 4);
+        bool mixed = data[21] != 0;
+
+        FrameTiming& f = frames[frameId % HISTORY];
+        if (!f.valid || f.frameId != frameId || f.captureUs != captureUs || chunkIdx >= NUM_CHUNKS) return;
+        f.valid = false;
+
+        // t1 host send, t2 device receive, t3 device reply, t4 host receive
+        uint32_t t1 = f.chunkSendUs[chunkIdx];
+        int32_t rtt = (int32_t)(recvUs - t1) - (int32_t)(displayedUs - chunkRxUs);
+        if (rtt >= 0) {
+            offsetSamples[offsetNext].offset = chunkRxUs - t1 - (uint32_t)(rtt / 2);
+            offsetSamples[offsetNext].rtt = rtt;
+            offsetNext = (offsetNext + 1) % OFFSET_WINDOW;
+            if (offsetCount < OFFSET_WINDOW) offsetCount++;
+
+            int best = 0;
+            for (int i = 1; i < offsetCount; i++) {
+                if (offsetSamples[i].rtt < offsetSamples[best].rtt) best = i;
+            }
+            offsetUs = offsetSamples[best].offset;
+        }
+        // Part of the image came from older frames - the stages would not describe one capture
+        if (mixed) {
+            framesMixed++;
+            return;
+        }
+        if (offsetCount == 0) return;
+
+        capToTx.push_back((int32_t)(f.sentUs - f.captureUs));
+        txToRx.push_back((int32_t)(completeUs - offsetUs - f.sentUs));
+        rxToDisp.push_back((int32_t)(displayedUs - completeUs));
+        total.push_back((int32_t)(displayedUs - offsetUs - f.captureUs));
+    }
+
+    // Format p50/p95 per stage since the last call and reset the window
+    void summary(char* buf, size_t len) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (total.empty() && framesMixed == 0) {
+            snprintf(buf, len, "Latency: waiting for device reports (%d sent)", framesSent);
+        } else if (total.empty()) {
+            snprintf(buf, len, "Latency: %d/%d shown, all mixed (lost chunks)", framesMixed, framesSent);
+        } else {
+            snprintf(buf, len, "p50/p95 ms:");
+            appendStage(buf, len, "cap>tx", capToTx);
+            appendStage(buf, len, "tx>rx", txToRx);
+            appendStage(buf, len, "rx>disp", rxToDisp);
+            appendStage(buf, len, "total", total);
+            size_t used = strlen(buf);
+            snprintf(buf + used, len - used, "  (%d/%d shown, %d mixed)",
+                     (int)total.size() + framesMixed, framesSent, framesMixed);
+        }
+        capToTx.clear();
+        txToRx.clear();
+        rxToDisp.clear();
+        total.clear();
+        framesSent = 0;
+        framesMixed = 0;
+    }
+};
+
+// Token-bucket pacer using QPC and a high-resolution waitable timer (Sleep is ~1-15ms granular)
+class PacketPacer {
+private:
+    HANDLE hTimer;
+    bool highResTimer;
+    LARGE_INTEGER freq;
+    LONGLONG lastRefill;
+    double tokens;
+    double capacity;
+    double rate;  // bytes per second, <= 0 disables pacing
+
+    LONGLONG now() {
+        LARGE_INTEGER t;
+        QueryPerformanceCounter(&t);
+        return t.QuadPart;
+    }
+
+    void refill() {
+        LONGLONG t = now();
+        tokens += (double)(t - lastRefill) * rate / freq.QuadPart;
+        if (tokens > capacity) tokens = capacity;
+        lastRefill = t;
+    }
+
+    void sleepPrecise(double seconds) {
+        LONGLONG target = now() + (LONGLONG)(seconds * freq.QuadPart);
+        // Let the timer cover the bulk of the wait, then spin off the last stretch.
+        // A high-resolution timer handles sub-millisecond gaps; a legacy one is ~1ms granular.
+        double tail = highResTimer ? PACER_SPIN_TAIL : 0.001;
+        if (hTimer && seconds > 2 * tail) {
+            LARGE_INTEGER due;
+            due.QuadPart = -(LONGLONG)((seconds - tail) * 10000000.0);
+            if (SetWaitableTimer(hTimer, &due, 0, NULL, NULL, FALSE)) {
+                WaitForSingleObject(hTimer, INFINITE);
+            }
+        }
+        while (now() < target) {
+            YieldProcessor();
+        }
+    }
+
+public:
+    PacketPacer() : tokens(0), capacity(0), rate(0) {
+        QueryPerformanceFrequency(&freq);
+        lastRefill = now();
+        hTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        highResTimer = (hTimer != NULL);
+        if (!hTimer) {
+            // Pre-1803 Windows: fall back to a regular timer
+            hTimer = CreateWaitableTimerW(NULL, TRUE, NULL);
+        }
+    }
+
+    ~PacketPacer() {
+        if (hTimer) CloseHandle(hTimer);
+    }
+
+    void setRate(double bytesPerSec, double burstBytes) {
+        refill();
+        rate = bytesPerSec;
+        capacity = burstBytes;
+        if (tokens > capacity) tokens = capacity;
+    }
+
+    // Take the tokens for a packet of this size if the bucket holds enough.
+    // If the timer overshoots, the extra tokens let the next few packets go straight out.
+    bool tryConsume(int bytes) {
+        if (rate <= 0) return true;
+        refill();
+        if (tokens < bytes) return false;
+        tokens -= bytes;
+        return true;
+    }
+
+    // Sleep until the bucket should hold enough tokens for a packet of this size
+    void waitFor(int bytes) {
+        if (rate <= 0) return;
+        refill();
+        if (tokens < bytes) {
+            sleepPrecise((bytes - tokens) / rate);
+        }
+    }
+};
+
 class ScreenStreamer {
 private:
     SOCKET sock;
@@ -87,9 +348,23 @@ private:
     std::vector<uint8_t> screenBuffer;
     std::vector<uint16_t> frameBuffer;
     std::vector<uint8_t> sendBuffer;
+    PacketPacer pacer;
+    LatencyTracker latency;
+    std::thread reportThread;
+    std::atomic<bool> reportThreadRunning;
+    uint16_t frameId;
+    uint32_t captureUs;
     int screenWidth, screenHeight;
     int currentScreenIdx;
     int monitorLeft, monitorTop;
+    int displayW, displayH, offsetX, offsetY;
+    
+    // Cursor sprite cache - rasterised once per cursor shape at display resolution
+    HCURSOR cursorHandle;
+    std::vector<uint8_t> cursorSprite;  // premultiplied BGRA
+    std::vector<uint8_t> cursorInvert;  // 1 where the cursor inverts the screen (e.g. I-beam)
+    int cursorSpriteW, cursorSpriteH;
+    int cursorHotX, cursorHotY;
 
     void setupCapture() {
         // Clean up ALL existing resources
@@ -139,10 +414,204 @@ private:
         bi.biCompression = BI_RGB;
 
         screenBuffer.resize(screenWidth * screenHeight * 4);
+
+        // Calculate aspect ratio scaling to fit with black borders
+        float screenAspect = (float)screenWidth / screenHeight;
+        float displayAspect = (float)DISPLAY_WIDTH / DISPLAY_HEIGHT;
+        
+        if (screenAspect > displayAspect) {
+            // Screen is wider - use full width, add top/bottom black bars
+            displayW = DISPLAY_WIDTH;
+            displayH = (int)(DISPLAY_WIDTH / screenAspect);
+            offsetX = 0;
+            offsetY = (DISPLAY_HEIGHT - displayH) / 2;
+        } else {
+            // Screen is taller - use full height, add left/right black bars
+            displayH = DISPLAY_HEIGHT;
+            displayW = (int)(DISPLAY_HEIGHT * screenAspect);
+            offsetX = (DISPLAY_WIDTH - displayW) / 2;
+            offsetY = 0;
+        }
+        
+        // Scale changed - force the cursor sprite to be rebuilt
+        cursorHandle = NULL;
+    }
+
+    // Rasterise the cursor at native size and box-filter it down to display scale.
+    // Drawing onto black and white backgrounds recovers per-pixel alpha for
+    // both colour and monochrome (mask-only) cursors; pixels that come out
+    // darker on white than on black are inverting and go to a separate mask.
+    bool rasterizeCursor(HCURSOR hCursor) {
+        cursorSprite.clear();
+        cursorInvert.clear();
+        cursorSpriteW = cursorSpriteH = 0;
+        
+        ICONINFO ii;
+        if (!GetIconInfo(hCursor, &ii)) return false;
+        
+        BITMAP bm = {0};
+        GetObject(ii.hbmColor ? ii.hbmColor : ii.hbmMask, sizeof(BITMAP), &bm);
+        int w = bm.bmWidth;
+        int h = ii.hbmColor ? bm.bmHeight : bm.bmHeight / 2;
+        int hotX = ii.xHotspot;
+        int hotY = ii.yHotspot;
+        if (ii.hbmColor) DeleteObject(ii.hbmColor);
+        if (ii.hbmMask) DeleteObject(ii.hbmMask);
+        if (w <= 0 || h <= 0) return false;
+        
+        BITMAPINFO bmi = {0};
+        bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bmi.bmiHeader.biWidth = w;
+        bmi.bmiHeader.biHeight = -h;
+        bmi.bmiHeader.biPlanes = 1;
+        bmi.bmiHeader.biBitCount = 32;
+        bmi.bmiHeader.biCompression = BI_RGB;
+        
+        void* bitsBlack = NULL;
+        void* bitsWhite = NULL;
+        HDC hdcCursor = CreateCompatibleDC(hdcScreen);
+        HBITMAP hbmBlack = CreateDIBSection(hdcScreen, &bmi, DIB_RGB_COLORS, &bitsBlack, NULL, 0);
+        HBITMAP hbmWhite = CreateDIBSection(hdcScreen, &bmi, DIB_RGB_COLORS, &bitsWhite, NULL, 0);
+        if (!hdcCursor || !hbmBlack || !hbmWhite) {
+            if (hbmBlack) DeleteObject(hbmBlack);
+            if (hbmWhite) DeleteObject(hbmWhite);
+            if (hdcCursor) DeleteDC(hdcCursor);
+            return false;
+        }
+        
+        memset(bitsBlack, 0x00, w * h * 4);
+        memset(bitsWhite, 0xFF, w * h * 4);
+        HGDIOBJ hOld = SelectObject(hdcCursor, hbmBlack);
+        DrawIconEx(hdcCursor, 0, 0, hCursor, w, h, 0, NULL, DI_NORMAL);
+        SelectObject(hdcCursor, hbmWhite);
+        DrawIconEx(hdcCursor, 0, 0, hCursor, w, h, 0, NULL, DI_NORMAL);
+        SelectObject(hdcCursor, hOld);
+        GdiFlush();
+        
+        // Native-resolution premultiplied BGRA: on black the result is alpha*colour,
+        // and the difference between the two passes is (255 - alpha)
+        std::vector<uint8_t> native(w * h * 4);
+        std::vector<uint8_t> nativeInvert(w * h, 0);
+        const uint8_t* pb = (const uint8_t*)bitsBlack;
+        const uint8_t* pw = (const uint8_t*)bitsWhite;
+        for (int i = 0; i < w * h; i++) {
+            int diff = (pw[i*4] - pb[i*4]) + (pw[i*4+1] - pb[i*4+1]) + (pw[i*4+2] - pb[i*4+2]);
+            if (diff < 0) {
+                // XOR pixel - leave it out of the alpha sprite
+                nativeInvert[i] = 1;
+                native[i*4] = native[i*4+1] = native[i*4+2] = native[i*4+3] = 0;
+                continue;
+            }
+            int a = 255 - diff / 3;
+            if (a < 0) a = 0;
+            if (a > 255) a = 255;
+            native[i*4] = (pb[i*4] < a) ? pb[i*4] : a;
+            native[i*4+1] = (pb[i*4+1] < a) ? pb[i*4+1] : a;
+            native[i*4+2] = (pb[i*4+2] < a) ? pb[i*4+2] : a;
+            native[i*4+3] = a;
+        }
+        
+        DeleteObject(hbmBlack);
+        DeleteObject(hbmWhite);
+        DeleteDC(hdcCursor);
+        
+        // Downscale with the same ratio as the screen image
+        int sw = (w * displayW + screenWidth - 1) / screenWidth;
+        int sh = (h * displayH + screenHeight - 1) / screenHeight;
+        if (sw < 1) sw = 1;
+        if (sh < 1) sh = 1;
+        
+        cursorSprite.assign(sw * sh * 4, 0);
+        cursorInvert.assign(sw * sh, 0);
+        for (int y = 0; y < sh; y++) {
+            int y0 = (y * h) / sh;
+            int y1 = ((y + 1) * h) / sh;
+            if (y1 <= y0) y1 = y0 + 1;
+            for (int x = 0; x < sw; x++) {
+                int x0 = (x * w) / sw;
+                int x1 = ((x + 1) * w) / sw;
+                if (x1 <= x0) x1 = x0 + 1;
+                
+                int sum[4] = {0, 0, 0, 0};
+                int inverted = 0;
+                for (int sy = y0; sy < y1; sy++) {
+                    for (int sx = x0; sx < x1; sx++) {
+                        const uint8_t* p = &native[(sy * w + sx) * 4];
+                        sum[0] += p[0]; sum[1] += p[1]; sum[2] += p[2]; sum[3] += p[3];
+                        inverted |= nativeInvert[sy * w + sx];
+                    }
+                }
+                // Any inverting source pixel inverts the whole box, so thin I-beams survive downscaling
+                cursorInvert[y * sw + x] = inverted;
+                int count = (y1 - y0) * (x1 - x0);
+                uint8_t* d = &cursorSprite[(y * sw + x) * 4];
+                d[0] = sum[0] / count;
+                d[1] = sum[1] / count;
+                d[2] = sum[2] / count;
+                d[3] = sum[3] / count;
+            }
+        }
+        
+        cursorSpriteW = sw;
+        cursorSpriteH = sh;
+        cursorHotX = (hotX * displayW) / screenWidth;
+        cursorHotY = (hotY * displayH) / screenHeight;
+        return true;
+    }
+
+    // Alpha-blend the cached cursor sprite onto the downscaled frame, inverting where the cursor does
+    void compositeCursor() {
+        CURSORINFO ci = { sizeof(CURSORINFO) };
+        if (!GetCursorInfo(&ci) || ci.flags != CURSOR_SHOWING || !ci.hCursor) return;
+        
+        // Adjust cursor position relative to current monitor
+        int cursorX = ci.ptScreenPos.x - monitorLeft;
+        int cursorY = ci.ptScreenPos.y - monitorTop;
+        // Only draw cursor if it's on this monitor
+        if (cursorX < 0 || cursorX >= screenWidth || cursorY < 0 || cursorY >= screenHeight) return;
+        
+        if (ci.hCursor != cursorHandle) {
+            cursorHandle = ci.hCursor;
+            rasterizeCursor(ci.hCursor);
+        }
+        if (cursorSprite.empty()) return;
+        
+        int left = offsetX + (cursorX * displayW) / screenWidth - cursorHotX;
+        int top = offsetY + (cursorY * displayH) / screenHeight - cursorHotY;
+        
+        for (int y = 0; y < cursorSpriteH; y++) {
+            int dst_y = top + y;
+            if (dst_y < 0 || dst_y >= DISPLAY_HEIGHT) continue;
+            for (int x = 0; x < cursorSpriteW; x++) {
+                int dst_x = left + x;
+                if (dst_x < 0 || dst_x >= DISPLAY_WIDTH) continue;
+                
+                const uint8_t* s = &cursorSprite[(y * cursorSpriteW + x) * 4];
+                int a = s[3];
+                bool invert = cursorInvert[y * cursorSpriteW + x] != 0;
+                if (a == 0 && !invert) continue;
+                
+                uint16_t& dst = frameBuffer[dst_y * DISPLAY_WIDTH + dst_x];
+                uint8_t r, g, b;
+                rgb565_to_rgb888(dst, r, g, b);
+                int inv = 255 - a;
+                r = clamp(s[2] + (r * inv) / 255);
+                g = clamp(s[1] + (g * inv) / 255);
+                b = clamp(s[0] + (b * inv) / 255);
+                if (invert) {
+                    r = 255 - r;
+                    g = 255 - g;
+                    b = 255 - b;
+                }
+                dst = rgb888_to_rgb565(r, g, b);
+            }
+        }
     }
 
 public:
-    ScreenStreamer(const char* ip, int port) : hdcScreen(NULL), hdcMem(NULL), hbmScreen(NULL) {
+    ScreenStreamer(const char* ip, int port) : hdcScreen(NULL), hdcMem(NULL), hbmScreen(NULL),
+        reportThreadRunning(false), frameId(0), captureUs(0),
+        cursorHandle(NULL), cursorSpriteW(0), cursorSpriteH(0), cursorHotX(0), cursorHotY(0) {
         WSADATA wsaData;
         WSAStartup(MAKEWORD(2, 2), &wsaData);
         sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
@@ -150,22 +619,34 @@ public:
         setsockopt(sock, SOL_SOCKET, SO_SNDBUF, (char*)&sendBufSize, sizeof(sendBufSize));
         DWORD timeout = 1;
         setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, (char*)&timeout, sizeof(timeout));
+        
+        // Bind up front so the report thread can recv() before the first sendto()
+        sockaddr_in local_addr = {0};
+        local_addr.sin_family = AF_INET;
+        local_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        bind(sock, (sockaddr*)&local_addr, sizeof(local_addr));
 
         dest_addr.sin_family = AF_INET;
         dest_addr.sin_port = htons(port);
         inet_pton(AF_INET, ip, &dest_addr.sin_addr);
         
         frameBuffer.resize(DISPLAY_WIDTH * DISPLAY_HEIGHT);
-        sendBuffer.resize(CHUNK_SIZE + 3);
+        sendBuffer.resize(CHUNK_SIZE + HEADER_SIZE);
         
         setupCapture();
+        
+        reportThreadRunning = true;
+        reportThread = std::thread(&ScreenStreamer::receiveReports, this);
     }
 
     ~ScreenStreamer() {
         DeleteObject(hbmScreen);
         DeleteDC(hdcMem);
         ReleaseDC(NULL, hdcScreen);
+        // Closing the socket unblocks recv() in the report thread
+        reportThreadRunning = false;
         closesocket(sock);
+        if (reportThread.joinable()) reportThread.join();
         WSACleanup();
     }
 
@@ -176,45 +657,14 @@ public:
             setupCapture();
         }
         
-        BitBlt(hdcMem, 0, 0, screenWidth, screenHeight, hdcScreen, monitorLeft, monitorTop, SRCCOPY);
-        
-        if (g_showCursor) {
-            CURSORINFO ci = { sizeof(CURSORINFO) };
-            if (GetCursorInfo(&ci) && ci.flags == CURSOR_SHOWING) {
-                POINT pt;
-                GetCursorPos(&pt);
-                // Adjust cursor position relative to current monitor
-                int cursorX = pt.x - monitorLeft;
-                int cursorY = pt.y - monitorTop;
-                // Only draw cursor if it's on this monitor
-                if (cursorX >= 0 && cursorX < screenWidth && cursorY >= 0 && cursorY < screenHeight) {
-                    DrawIconEx(hdcMem, cursorX, cursorY, ci.hCursor, 0, 0, 0, NULL, DI_NORMAL);
-                }
-            }
-        }
+        frameId++;
+        captureUs = hostMicros();
+        latency.onCapture(frameId, captureUs);
         
+        // Cursor is composited after downscaling, so the full-resolution capture only holds screen content
+        BitBlt(hdcMem, 0, 0, screenWidth, screenHeight, hdcScreen, monitorLeft, monitorTop, SRCCOPY);
         GetDIBits(hdcMem, hbmScreen, 0, screenHeight, screenBuffer.data(), (BITMAPINFO*)&bi, DIB_RGB_COLORS);
 
-        // Calculate aspect ratio scaling to fit with black borders
-        float screenAspect = (float)screenWidth / screenHeight;
-        float displayAspect = (float)DISPLAY_WIDTH / DISPLAY_HEIGHT;
-        
-        int displayW, displayH, offsetX, offsetY;
-        
-        if (screenAspect > displayAspect) {
-            // Screen is wider - use full width, add top/bottom black bars
-            displayW = DISPLAY_WIDTH;
-            displayH = (int)(DISPLAY_WIDTH / screenAspect);
-            offsetX = 0;
-            offsetY = (DISPLAY_HEIGHT - displayH) / 2;
-        } else {
-            // Screen is taller - use full height, add left/right black bars
-            displayH = DISPLAY_HEIGHT;
-            displayW = (int)(DISPLAY_HEIGHT * screenAspect);
-            offsetX = (DISPLAY_WIDTH - displayW) / 2;
-            offsetY = 0;
-        }
-        
         // Clear to black
         memset(frameBuffer.data(), 0, FRAME_SIZE);
         
@@ -237,25 +687,77 @@ public:
             }
         }
         
+        if (g_showCursor) {
+            compositeCursor();
+        }
+        
         if (g_previewBuffer.size() > 0) {
             memcpy(g_previewBuffer.data(), frameBuffer.data(), FRAME_SIZE);
             if (g_hwndPreview) InvalidateRect(g_hwndPreview, NULL, FALSE);
         }
     }
 
+    void updatePacing() {
+        int mbps = g_pacingMbps.load();
+        double rate;
+        if (mbps < 0) {
+            rate = 0;
+        } else if (mbps == 0) {
+            // Auto: fit one frame's packets into part of the frame interval
+            double frameBytes = FRAME_SIZE + NUM_CHUNKS * HEADER_SIZE;
+            rate = frameBytes * g_targetFPS.load() / PACER_AUTO_SPREAD;
+        } else {
+            // Never pace slower than Auto, or the send alone would eat the frame interval
+            rate = mbps * 1000000.0 / 8.0;
+            double frameBytes = FRAME_SIZE + NUM_CHUNKS * HEADER_SIZE;
+            double minRate = frameBytes * g_targetFPS.load() / PACER_AUTO_SPREAD;
+            if (rate < minRate) rate = minRate;
+        }
+        pacer.setRate(rate, PACER_BURST_PACKETS * (CHUNK_SIZE + HEADER_SIZE));
+    }
+
     void sendFrame() {
         uint8_t* frameData = (uint8_t*)frameBuffer.data();
-        int num_chunks = (FRAME_SIZE + CHUNK_SIZE - 1) / CHUNK_SIZE;
-        for (int chunk_idx = 0; chunk_idx < num_chunks; chunk_idx++) {
+        updatePacing();
+        for (int chunk_idx = 0; chunk_idx < NUM_CHUNKS; chunk_idx++) {
             int offset = chunk_idx * CHUNK_SIZE;
             int chunk_size = (offset + CHUNK_SIZE > FRAME_SIZE) ? (FRAME_SIZE - offset) : CHUNK_SIZE;
+            while (!pacer.tryConsume(chunk_size + HEADER_SIZE)) {
+                pacer.waitFor(chunk_size + HEADER_SIZE);
+            }
             sendBuffer[0] = 0xAA;
             sendBuffer[1] = 0x55;
             sendBuffer[2] = chunk_idx;
-            memcpy(sendBuffer.data() + 3, frameData + offset, chunk_size);
-            sendto(sock, (char*)sendBuffer.data(), chunk_size + 3, 0, (sockaddr*)&dest_addr, sizeof(dest_addr));
+            memcpy(sendBuffer.data() + 3, &frameId, 2);
+            memcpy(sendBuffer.data() + 5, &captureUs, 4);
+            memcpy(sendBuffer.data() + HEADER_SIZE, frameData + offset, chunk_size);
+            latency.onChunkSent(frameId, chunk_idx, hostMicros());
+            sendto(sock, (char*)sendBuffer.data(), chunk_size + HEADER_SIZE, 0, (sockaddr*)&dest_addr, sizeof(dest_addr));
+        }
+        latency.onFrameSent(frameId, hostMicros());
+    }
+
+    // Blocks on recv() so device reports are timestamped the moment they arrive,
+    // whatever the stream thread is doing (capture, paced send or frame wait)
+    void receiveReports() {
+        uint8_t report[64];
+        while (reportThreadRunning) {
+            int len = recv(sock, (char*)report, sizeof(report), 0);
+            uint32_t recvUs = hostMicros();
+            if (len == SOCKET_ERROR) {
+                // ICMP port-unreachable shows up as WSAECONNRESET on UDP - keep listening
+                if (WSAGetLastError() == WSAECONNRESET) continue;
+                break;
+            }
+            if (len == REPORT_SIZE && report[0] == 0xAA && report[1] == 0x56) {
+                latency.onReport(report, recvUs);
+            }
         }
     }
+
+    void latencySummary(char* buf, size_t len) {
+        latency.summary(buf, len);
+    }
 };
 
 void StreamThread(std::string ip) {
@@ -268,6 +770,7 @@ void StreamThread(std::string ip) {
     int frameCount = 0;
     
     while (g_streaming) {
+        auto frameStart = std::chrono::high_resolution_clock::now();
         UpdateStatus("[*] STREAMING...");
         streamer.captureAndResize();
         streamer.sendFrame();
@@ -277,12 +780,23 @@ void StreamThread(std::string ip) {
         float elapsed = std::chrono::duration<float>(now - lastTime).count();
         if (elapsed >= 1.0f) {
             UpdateFPS(frameCount / elapsed);
+            char latencyText[160];
+            streamer.latencySummary(latencyText, sizeof(latencyText));
+            UpdateLatency(latencyText);
             frameCount = 0;
             lastTime = now;
         }
         
-        int delay = 1000 / g_targetFPS;
-        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        // Paced sends take up part of the frame interval - only wait for the rest.
+        // With pacing off keep the original cadence (full interval after each send).
+        std::chrono::microseconds delay(1000000 / g_targetFPS);
+        if (g_pacingMbps.load() >= 0) {
+            delay -= std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - frameStart);
+        }
+        if (delay > std::chrono::microseconds(0)) {
+            std::this_thread::sleep_for(delay);
+        }
     }
 }
 
@@ -394,19 +908,8 @@ LRESULT CALLBACK PreviewWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lPara
                 
                 std::vector<uint8_t> rgb888(DISPLAY_WIDTH * DISPLAY_HEIGHT * 3);
                 for (int i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT; i++) {
-                    uint16_t rgb565 = g_previewBuffer[i];
-                    // Swap bytes back
-                    rgb565 = (rgb565 >> 8) | (rgb565 << 8);
-                    
-                    // Decode RGB565 back to RGB888 (reverse of standard conversion)
-                    uint8_t r = (rgb565 >> 8) & 0xF8;  // Extract R (top 5 bits)
-                    uint8_t g = (rgb565 >> 3) & 0xFC;  // Extract G (middle 6 bits)
-                    uint8_t b = (rgb565 << 3) & 0xF8;  // Extract B (bottom 5 bits)
-                    
-                    // Fill in lower bits for smoother preview
-                    r |= (r >> 5);
-                    g |= (g >> 6);
-                    b |= (b >> 5);
+                    uint8_t r, g, b;
+                    rgb565_to_rgb888(g_previewBuffer[i], r, g, b);
                     
                     rgb888[i*3] = b;
                     rgb888[i*3+1] = g;
@@ -563,6 +1066,10 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
             } else if (HIWORD(wParam) == CBN_SELCHANGE && LOWORD(wParam) == ID_SCREEN_COMBO) {
                 int sel = SendMessageA(g_hwndScreenCombo, CB_GETCURSEL, 0, 0);
                 if (sel >= 0 && sel < (int)g_monitors.size()) g_selectedScreen = sel;
+            } else if (HIWORD(wParam) == CBN_SELCHANGE && LOWORD(wParam) == ID_PACING_COMBO) {
+                int sel = SendMessageA(g_hwndPacingCombo, CB_GETCURSEL, 0, 0);
+                int pacing_values[] = {0, -1, 20, 30, 40, 60};
+                if (sel >= 0 && sel < 6) g_pacingMbps = pacing_values[sel];
             }
             return 0;
             
@@ -602,7 +1109,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
 
     g_hwndMain = CreateWindowExA(0, "M5ScreenStreamer", "M5 Screen Streamer",
         WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_MINIMIZEBOX,
-        CW_USEDEFAULT, CW_USEDEFAULT, 550, 520, NULL, NULL, hInstance, NULL);
+        CW_USEDEFAULT, CW_USEDEFAULT, 550, 572, NULL, NULL, hInstance, NULL);
 
     g_hBrushBg = CreateSolidBrush(COLOR_BG);
     g_hFontLarge = CreateFontA(26, 0, 0, 0, FW_BOLD, 0, 0, 0, 0, 0, 0, ANTIALIASED_QUALITY, 0, "Segoe UI");
@@ -652,7 +1159,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
 
     // Settings section
     HWND hwndSettingsBox = CreateWindowExA(0, "BUTTON", "Settings",
-        WS_CHILD | WS_VISIBLE | BS_GROUPBOX, 20, 210, 510, 68, g_hwndMain, NULL, hInstance, NULL);
+        WS_CHILD | WS_VISIBLE | BS_GROUPBOX, 20, 210, 510, 100, g_hwndMain, NULL, hInstance, NULL);
     SendMessage(hwndSettingsBox, WM_SETFONT, (WPARAM)g_hFontNormal, TRUE);
 
     HWND hwndScreenLabel = CreateWindowExA(0, "STATIC", "Screen:", WS_CHILD | WS_VISIBLE,
@@ -690,13 +1197,32 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
     SendMessage(g_hwndCursorCheck, BM_SETCHECK, BST_CHECKED, 0);
     SendMessage(g_hwndCursorCheck, WM_SETFONT, (WPARAM)g_hFontNormal, TRUE);
     
+    HWND hwndPacingLabel = CreateWindowExA(0, "STATIC", "Pacing:", WS_CHILD | WS_VISIBLE,
+        35, 269, 75, 20, g_hwndMain, NULL, hInstance, NULL);
+    SendMessage(hwndPacingLabel, WM_SETFONT, (WPARAM)g_hFontNormal, TRUE);
+    
+    g_hwndPacingCombo = CreateWindowExA(0, "COMBOBOX", NULL, WS_CHILD | WS_VISIBLE | CBS_DROPDOWNLIST | WS_VSCROLL,
+        115, 267, 150, 150, g_hwndMain, (HMENU)ID_PACING_COMBO, hInstance, NULL);
+    SendMessageA(g_hwndPacingCombo, CB_ADDSTRING, 0, (LPARAM)"Auto");
+    SendMessageA(g_hwndPacingCombo, CB_ADDSTRING, 0, (LPARAM)"Off (burst)");
+    SendMessageA(g_hwndPacingCombo, CB_ADDSTRING, 0, (LPARAM)"20 Mbps");
+    SendMessageA(g_hwndPacingCombo, CB_ADDSTRING, 0, (LPARAM)"30 Mbps");
+    SendMessageA(g_hwndPacingCombo, CB_ADDSTRING, 0, (LPARAM)"40 Mbps");
+    SendMessageA(g_hwndPacingCombo, CB_ADDSTRING, 0, (LPARAM)"60 Mbps");
+    SendMessageA(g_hwndPacingCombo, CB_SETCURSEL, 0, 0);
+    SendMessage(g_hwndPacingCombo, WM_SETFONT, (WPARAM)g_hFontNormal, TRUE);
+    
     // Preview section
     HWND hwndPreviewBox = CreateWindowExA(0, "BUTTON", "Live Preview",
-        WS_CHILD | WS_VISIBLE | BS_GROUPBOX, 20, 288, 510, 185, g_hwndMain, NULL, hInstance, NULL);
+        WS_CHILD | WS_VISIBLE | BS_GROUPBOX, 20, 320, 510, 205, g_hwndMain, NULL, hInstance, NULL);
     SendMessage(hwndPreviewBox, WM_SETFONT, (WPARAM)g_hFontNormal, TRUE);
     
     g_hwndPreview = CreateWindowExA(WS_EX_CLIENTEDGE, "M5PreviewWindow", NULL, WS_CHILD | WS_VISIBLE,
-        155, 310, 240, 135, g_hwndMain, NULL, hInstance, NULL);
+        155, 342, 240, 135, g_hwndMain, NULL, hInstance, NULL);
+    
+    g_hwndLatency = CreateWindowExA(0, "STATIC", "Latency: -", WS_CHILD | WS_VISIBLE | SS_CENTER,
+        35, 490, 485, 20, g_hwndMain, NULL, hInstance, NULL);
+    SendMessage(g_hwndLatency, WM_SETFONT, (WPARAM)g_hFontSmall, TRUE);
     
     g_previewBuffer.resize(DISPLAY_WIDTH * DISPLAY_HEIGHT, 0);
 